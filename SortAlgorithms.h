@@ -2,6 +2,12 @@
 #define SORT_ALGORITHMS_H
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace sort
@@ -36,21 +42,28 @@ namespace sort
     template<typename Iterator, typename Compare = std::less<>>
     void insertSort(Iterator begin, Iterator end, Compare comp = Compare()) {
         for(Iterator i = std::next(begin); i != end; i++) {
+            // shifting instead of swapping moves every element once per step;
+            // value_type and not auto, because *i may be a proxy reference (std::vector<bool>)
+            typename std::iterator_traits<Iterator>::value_type value = std::move(*i);
             Iterator j = i;
-            while (j != begin && comp(*j, *std::prev(j)))
+            while (j != begin && comp(value, *std::prev(j)))
             {
-                std::iter_swap(j, std::prev(j));
+                *j = std::move(*std::prev(j));
                 j = std::prev(j);
             }
+            *j = std::move(value);
         }
     }
 
     template<typename Container, typename Compare = std::less<>>
     void insertSort(Container&& container, Compare comp = Compare()) {
         for(size_t i = 1; i < container.size(); ++i) {
-            for(size_t j = i; j != 0 && comp(container[j], container[j - 1]); --j) {
-                std::swap(container[j], container[j - 1]);
+            typename std::decay_t<Container>::value_type value = std::move(container[i]);
+            size_t j = i;
+            for(; j != 0 && comp(value, container[j - 1]); --j) {
+                container[j] = std::move(container[j - 1]);
             }
+            container[j] = std::move(value);
         }
         // or just
         //insertSort(std::begin(container), std::end(container), comp);
@@ -153,30 +166,59 @@ namespace sort
                 }
             }
         }
+
+        constexpr size_t quickSortInsertLimit = 16; // smaller ranges are finished by insertSort
+
+        // three-way partitioning: keys equal to the pivot leave the recursion at once,
+        // only the smaller side is recursed into and a heap sort takes over past depthLimit
+        template<typename Iterator, typename Compare>
+        void quickSortLoop(Iterator begin, Iterator end, Compare comp, size_t depthLimit) {
+            while(static_cast<size_t>(std::distance(begin, end)) > quickSortInsertLimit) {
+                if(depthLimit-- == 0) {
+                    std::make_heap(begin, end, comp);
+                    std::sort_heap(begin, end, comp);
+                    return;
+                }
+                Iterator last = std::prev(end);
+                Iterator middle = begin + (std::distance(begin, end) / 2);
+                typename std::iterator_traits<Iterator>::value_type pivotValue = *medianOfThree(begin, middle, last, comp);
+
+                // [begin, less) < pivot, [less, current) == pivot, [greater, end) > pivot
+                Iterator less    = begin;
+                Iterator current = begin;
+                Iterator greater = end;
+                while(current != greater) {
+                    if(comp(*current, pivotValue)) {
+                        std::iter_swap(less++, current++);
+                    } else if(comp(pivotValue, *current)) {
+                        std::iter_swap(current, --greater);
+                    } else {
+                        ++current;
+                    }
+                }
+
+                if(std::distance(begin, less) < std::distance(greater, end)) {
+                    quickSortLoop(begin, less, comp, depthLimit);
+                    begin = greater;
+                } else {
+                    quickSortLoop(greater, end, comp, depthLimit);
+                    end = less;
+                }
+            }
+            if(std::distance(begin, end) > 1) {
+                insertSort(begin, end, comp);
+            }
+        }
     }
         // Quick sort functions
         template<typename Iterator, typename Compare = std::less<>>
         void quickSort(Iterator begin, Iterator end, Compare comp = Compare()) {
-            if (std::distance(begin, end) <= 1) {
-                return;
+            // 2 * log2(n) levels before the heap sort fallback
+            size_t depthLimit = 0;
+            for(size_t size = std::distance(begin, end); size > 1; size /= 2) {
+                depthLimit += 2;
             }
-            
-            Iterator last = std::prev(end);
-            Iterator middle = begin + (std::distance(begin, end) / 2);
-            Iterator pivot = detail::medianOfThree(begin, middle, last, comp);
-            
-            auto pivotValue = *pivot;
-            std::iter_swap(pivot, last);
-            
-            // Partition up to last (not end), since last holds our pivot
-            Iterator partitionIter = std::partition(begin, last, [&](const auto& value) {
-                return comp(value, pivotValue);
-            });
-            
-            std::iter_swap(partitionIter, last);
-            
-            quickSort(begin, partitionIter, comp);
-            quickSort(std::next(partitionIter), end, comp);
+            detail::quickSortLoop(begin, end, comp, depthLimit);
         }
         
         template<typename Container, typename Compare = std::less<>>
@@ -230,6 +272,310 @@ namespace sort
         mergeSort(std::begin(container), std::end(container), comp);
     }
 
+//----------------Block Merge Sort-----------------------
+    namespace detail /*Block Merge Sort helper functions*/ {
+        constexpr size_t blockMergeRunSize = 32;   // runs of this length are sorted by insertSort first
+        constexpr size_t blockMergeMinSize = 1024; // smaller ranges are merged with rotations only
+
+        // merges through the buffer, only the shorter run is moved out of place
+        template<typename Iterator, typename BufferIterator, typename Compare>
+        void bufferedMerge(Iterator begin, Iterator middle, Iterator end, BufferIterator buffer, Compare comp) {
+            if(std::distance(begin, middle) <= std::distance(middle, end)) {
+                BufferIterator bufferEnd = std::move(begin, middle, buffer);
+                Iterator out = begin;
+                while(buffer != bufferEnd && middle != end) {
+                    if(comp(*middle, *buffer)) {
+                        *out++ = std::move(*middle++);
+                    } else {
+                        *out++ = std::move(*buffer++);
+                    }
+                }
+                std::move(buffer, bufferEnd, out);
+            } else {
+                BufferIterator bufferEnd = std::move(middle, end, buffer);
+                Iterator out = end;
+                while(buffer != bufferEnd && begin != middle) {
+                    if(comp(*std::prev(bufferEnd), *std::prev(middle))) {
+                        *--out = std::move(*--middle);
+                    } else {
+                        *--out = std::move(*--bufferEnd);
+                    }
+                }
+                std::move_backward(buffer, bufferEnd, out);
+            }
+        }
+
+        // stable merge of two sorted neighbouring runs with rotations, falls back to the buffer when the shorter run fits
+        template<typename Iterator, typename BufferIterator, typename Compare>
+        void rotationMerge(Iterator begin, Iterator middle, Iterator end,
+                           BufferIterator buffer, size_t bufferSize, Compare comp) {
+            if(begin == middle || middle == end || !comp(*middle, *std::prev(middle))) {
+                return;
+            }
+            // elements that are already in their final place do not take part in the merge
+            begin = std::upper_bound(begin, middle, *middle, comp);
+            end   = std::lower_bound(middle, end, *std::prev(middle), comp);
+
+            size_t leftSize  = std::distance(begin, middle);
+            size_t rightSize = std::distance(middle, end);
+            if(leftSize == 1 && rightSize == 1) {
+                std::iter_swap(begin, middle);
+                return;
+            }
+            if(std::min(leftSize, rightSize) <= bufferSize) {
+                bufferedMerge(begin, middle, end, buffer, comp);
+                return;
+            }
+
+            Iterator leftCut  = begin;
+            Iterator rightCut = middle;
+            if(leftSize > rightSize) {
+                leftCut  = begin + leftSize / 2;
+                rightCut = std::lower_bound(middle, end, *leftCut, comp);
+            } else {
+                rightCut = middle + rightSize / 2;
+                leftCut  = std::upper_bound(begin, middle, *rightCut, comp);
+            }
+            Iterator newMiddle = std::rotate(leftCut, middle, rightCut);
+
+            rotationMerge(begin, leftCut, newMiddle, buffer, bufferSize, comp);
+            rotationMerge(newMiddle, rightCut, end, buffer, bufferSize, comp);
+        }
+
+        // bottom-up merge sort with rotationMerge: linear merges when the buffer holds half of the range,
+        // O(n log^2 n) moves without it (cheap when there are only a few distinct values)
+        template<typename Iterator, typename BufferIterator, typename Compare>
+        void rotationMergeSort(Iterator begin, Iterator end, BufferIterator buffer, size_t bufferSize, Compare comp) {
+            size_t size = std::distance(begin, end);
+            for(size_t runBegin = 0; runBegin < size; runBegin += blockMergeRunSize) {
+                size_t runEnd = std::min(size, runBegin + blockMergeRunSize);
+                insertSort(begin + runBegin, begin + runEnd, comp);
+            }
+            for(size_t width = blockMergeRunSize; width < size; width *= 2) {
+                for(size_t left = 0; left + width < size; left += 2 * width) {
+                    size_t right = std::min(size, left + 2 * width);
+                    rotationMerge(begin + left, begin + left + width, begin + right, buffer, bufferSize, comp);
+                }
+            }
+        }
+
+        // moves up to keysNeeded distinct values to the front as a sorted run, the order of the
+        // other elements does not change; returns how many keys were found
+        template<typename Iterator, typename Compare>
+        size_t collectKeys(Iterator begin, Iterator end, size_t keysNeeded, Compare comp) {
+            Iterator keys = begin;
+            size_t keyCount = 1;
+            for(Iterator i = std::next(begin); i != end && keyCount < keysNeeded; ++i) {
+                Iterator keysEnd = keys + keyCount;
+                Iterator position = std::lower_bound(keys, keysEnd, *i, comp);
+                if(position != keysEnd && !comp(*i, *position)) {
+                    continue; // not unique
+                }
+                // the keys are rotated up to i, then *i is rotated into its place among them
+                size_t offset = std::distance(keys, position);
+                std::rotate(keys, keysEnd, i);
+                keys = i - keyCount;
+                std::rotate(keys + offset, i, std::next(i));
+                ++keyCount;
+            }
+            std::rotate(begin, keys, keys + keyCount);
+            return keyCount;
+        }
+
+        // the merges below swap instead of move, so the buffer may hold live elements (the internal keys);
+        // the buffer must be able to take the whole left run
+        template<typename Iterator, typename BufferIterator, typename Compare>
+        void swapMergeForward(Iterator begin, Iterator middle, Iterator end, BufferIterator buffer, Compare comp) {
+            BufferIterator bufferEnd = std::swap_ranges(begin, middle, buffer);
+            Iterator out = begin;
+            while(buffer != bufferEnd && middle != end) {
+                if(comp(*middle, *buffer)) {
+                    std::iter_swap(out++, middle++);
+                } else {
+                    std::iter_swap(out++, buffer++);
+                }
+            }
+            std::swap_ranges(buffer, bufferEnd, out);
+        }
+
+        // the same from the back, the buffer must be able to take the whole right run
+        template<typename Iterator, typename BufferIterator, typename Compare>
+        void swapMergeBackward(Iterator begin, Iterator middle, Iterator end, BufferIterator buffer, Compare comp) {
+            BufferIterator bufferEnd = std::swap_ranges(middle, end, buffer);
+            Iterator out = end;
+            while(buffer != bufferEnd && begin != middle) {
+                if(comp(*std::prev(bufferEnd), *std::prev(middle))) {
+                    std::iter_swap(--out, --middle);
+                } else {
+                    std::iter_swap(--out, --bufferEnd);
+                }
+            }
+            std::swap_ranges(buffer, bufferEnd, middle);
+        }
+
+        // merges [begin, middle) (a multiple of blockSize long) with [middle, end):
+        // the full blocks are ordered by their first element, the sorted tags tell which run a block came from,
+        // then neighbouring blocks of different runs are merged through the buffer; the last partial block is merged at the end
+        template<typename Iterator, typename BufferIterator, typename Compare>
+        void blockMerge(Iterator begin, Iterator middle, Iterator end, Iterator tags,
+                        BufferIterator buffer, size_t blockSize, Compare comp) {
+            size_t leftBlocks  = std::distance(begin, middle) / blockSize;
+            size_t rightBlocks = std::distance(middle, end) / blockSize;
+            size_t blockCount  = leftBlocks + rightBlocks;
+            Iterator blocksEnd = begin + blockCount * blockSize;
+
+            if(rightBlocks != 0) {
+                // tags smaller than the tag of the first right block mark the left blocks
+                size_t midTag = leftBlocks;
+                for(size_t i = 0; i < blockCount; ++i) {
+                    size_t minBlock = i;
+                    for(size_t j = i + 1; j < blockCount; ++j) {
+                        if(comp(begin[j * blockSize], begin[minBlock * blockSize]) ||
+                           (!comp(begin[minBlock * blockSize], begin[j * blockSize]) && comp(tags[j], tags[minBlock]))) {
+                            minBlock = j;
+                        }
+                    }
+                    if(minBlock != i) {
+                        std::swap_ranges(begin + i * blockSize, begin + (i + 1) * blockSize, begin + minBlock * blockSize);
+                        std::iter_swap(tags + i, tags + minBlock);
+                        if(midTag == i) {
+                            midTag = minBlock;
+                        } else if(midTag == minBlock) {
+                            midTag = i;
+                        }
+                    }
+                }
+
+                // [fragment, next block) is the part that is not final yet, all of it from the same run
+                Iterator fragment = begin;
+                bool fragmentFromLeft = comp(tags[0], tags[midTag]);
+                for(size_t i = 1; i < blockCount; ++i) {
+                    Iterator block    = begin + i * blockSize;
+                    Iterator blockEnd = block + blockSize;
+                    bool blockFromLeft = comp(tags[i], tags[midTag]);
+                    if(blockFromLeft == fragmentFromLeft) {
+                        fragment = block;
+                        continue;
+                    }
+                    BufferIterator current   = buffer;
+                    BufferIterator bufferEnd = std::swap_ranges(fragment, block, buffer);
+                    Iterator out   = fragment;
+                    Iterator right = block;
+                    while(current != bufferEnd && right != blockEnd) {
+                        // on equal keys the element of the left run goes first
+                        bool takeRight = fragmentFromLeft ? comp(*right, *current) : !comp(*current, *right);
+                        if(takeRight) {
+                            std::iter_swap(out++, right++);
+                        } else {
+                            std::iter_swap(out++, current++);
+                        }
+                    }
+                    if(current == bufferEnd) {
+                        fragment = right;
+                        fragmentFromLeft = blockFromLeft;
+                    } else {
+                        fragment = out;
+                        std::swap_ranges(current, bufferEnd, out);
+                    }
+                }
+                insertSort(tags, tags + blockCount, comp);
+            }
+            if(blocksEnd != end) {
+                swapMergeBackward(begin, blocksEnd, end, buffer, comp);
+            }
+        }
+
+        // bottom-up sort of [begin, end): merges whose left run fits into the buffer swap through it,
+        // longer ones are block merges
+        template<typename Iterator, typename BufferIterator, typename Compare>
+        void blockMergeRuns(Iterator begin, Iterator end, Iterator tags, BufferIterator buffer,
+                            size_t bufferSize, size_t blockSize, Compare comp) {
+            size_t size = std::distance(begin, end);
+            for(size_t runBegin = 0; runBegin < size; runBegin += blockMergeRunSize) {
+                insertSort(begin + runBegin, begin + std::min(size, runBegin + blockMergeRunSize), comp);
+            }
+            for(size_t width = blockMergeRunSize; width < size; width *= 2) {
+                for(size_t left = 0; left + width < size; left += 2 * width) {
+                    Iterator middle = begin + left + width;
+                    Iterator right  = begin + std::min(size, left + 2 * width);
+                    if(!comp(*middle, *std::prev(middle))) {
+                        continue;
+                    }
+                    if(width <= bufferSize) {
+                        swapMergeForward(begin + left, middle, right, buffer, comp);
+                    } else {
+                        blockMerge(begin + left, middle, right, tags, buffer, blockSize, comp);
+                    }
+                }
+            }
+        }
+
+        // merges the short sorted run [begin, middle) into [middle, end) with rotations;
+        // O(left^2 + n) moves, so linear for the sqrt(n) keys
+        template<typename Iterator, typename Compare>
+        void mergeShortLeft(Iterator begin, Iterator middle, Iterator end, Compare comp) {
+            while(begin != middle && middle != end) {
+                Iterator cut = std::lower_bound(middle, end, *begin, comp);
+                begin  = std::rotate(begin, middle, cut);
+                middle = cut;
+                if(middle == end) {
+                    break;
+                }
+                while(begin != middle && !comp(*middle, *begin)) {
+                    ++begin;
+                }
+            }
+        }
+    }
+    //* stable O(n log n) block merge sort (GrailSort style) that needs no extra memory:
+    //* 2 * sqrt(n) distinct keys are gathered at the front, half of them tag the blocks of a merge and
+    //* the other half serve as the swap buffer; at the end the keys are sorted and merged back in.
+    //* a caller buffer of at least sqrt(n) elements replaces the internal one, from size / 2 on
+    //* every merge is a plain buffered merge; with too few distinct values the runs are merged with rotations
+    template<typename Iterator, typename BufferIterator, typename Compare = std::less<>>
+    void blockMergeSort(Iterator begin, Iterator end, BufferIterator buffer, size_t bufferSize, Compare comp = Compare()) {
+        size_t size = std::distance(begin, end);
+        if(size <= 1) {
+            return;
+        }
+        if(size < detail::blockMergeMinSize || bufferSize >= size / 2) {
+            detail::rotationMergeSort(begin, end, buffer, bufferSize, comp);
+            return;
+        }
+
+        size_t blockSize = detail::blockMergeRunSize;
+        while(blockSize * blockSize < size) {
+            blockSize *= 2;
+        }
+        bool internalBuffer = bufferSize < blockSize;
+        size_t keysNeeded   = internalBuffer ? 2 * blockSize : blockSize;
+        if(detail::collectKeys(begin, end, keysNeeded, comp) < keysNeeded) {
+            detail::rotationMergeSort(begin, end, buffer, bufferSize, comp);
+            return;
+        }
+
+        Iterator keys  = begin;
+        Iterator first = begin + keysNeeded;
+        if(internalBuffer) {
+            // the keys after the tags are the buffer, they are only ever swapped
+            detail::blockMergeRuns(first, end, keys, keys + blockSize, blockSize, blockSize, comp);
+            quickSort(keys, first, comp); // the keys are distinct, so an unstable sort is enough
+        } else {
+            detail::blockMergeRuns(first, end, keys, buffer, bufferSize, blockSize, comp);
+        }
+        detail::mergeShortLeft(keys, first, end, comp);
+    }
+
+    template<typename Iterator, typename Compare = std::less<>>
+    void blockMergeSort(Iterator begin, Iterator end, Compare comp = Compare()) {
+        blockMergeSort(begin, end, begin, 0, comp);
+    }
+
+    template<typename Container, typename Compare = std::less<>>
+    void blockMergeSort(Container&& container, Compare comp = Compare()) {
+        blockMergeSort(std::begin(container), std::end(container), comp);
+    }
+
     
 //----------------Radix Sort----------------
     namespace detail/*helper function for Radix Sort algorithm*/ {
@@ -298,6 +644,253 @@ namespace sort
         radixSort(std::begin(container), std::end(container));
     }
 
+//----------------In-place MSD Radix Sort (American flag)----------------
+    namespace detail /*helper functions for in-place MSD Radix Sort*/ {
+        constexpr size_t radixBuckets     = 256; // one byte per pass
+        constexpr size_t radixInsertLimit = 64;  // smaller buckets are finished by insertSort
+
+        // maps an integer to an unsigned key with the same order (the sign bit is flipped for signed types)
+        template<typename T>
+        auto radixKey(T value) {
+            using Unsigned = std::make_unsigned_t<T>;
+            Unsigned key = static_cast<Unsigned>(value);
+            if constexpr (std::is_signed_v<T>) {
+                key ^= Unsigned(1) << (sizeof(T) * 8 - 1);
+            }
+            return key;
+        }
+
+        template<typename T>
+        size_t radixDigit(T value, int shift) {
+            return static_cast<size_t>((radixKey(value) >> shift) & (radixBuckets - 1));
+        }
+
+        // moves every element of [begin + head[b], begin + tail[b]) into its bucket by following the swap cycles
+        template<typename Iterator>
+        void americanFlagPermute(Iterator begin, size_t* head, const size_t* tail, int shift) {
+            for(size_t bucket = 0; bucket < radixBuckets; ++bucket) {
+                while(head[bucket] < tail[bucket]) {
+                    auto value = std::move(begin[head[bucket]]);
+                    size_t digit = radixDigit(value, shift);
+                    while(digit != bucket) {
+                        std::swap(value, begin[head[digit]++]);
+                        digit = radixDigit(value, shift);
+                    }
+                    begin[head[bucket]++] = std::move(value);
+                }
+            }
+        }
+
+        template<typename Iterator>
+        void americanFlagPass(Iterator begin, Iterator end, int shift) {
+            size_t size = std::distance(begin, end);
+            if(size <= radixInsertLimit) {
+                if(size > 1) {
+                    insertSort(begin, end);
+                }
+                return;
+            }
+
+            size_t count[radixBuckets] = {0};
+            for(Iterator i = begin; i != end; ++i) {
+                ++count[radixDigit(*i, shift)];
+            }
+
+            size_t head[radixBuckets];
+            size_t tail[radixBuckets];
+            size_t offset = 0;
+            for(size_t bucket = 0; bucket < radixBuckets; ++bucket) {
+                head[bucket] = offset;
+                offset += count[bucket];
+                tail[bucket] = offset;
+            }
+            americanFlagPermute(begin, head, tail, shift);
+
+            if(shift == 0) {
+                return;
+            }
+            size_t bucketBegin = 0;
+            for(size_t bucket = 0; bucket < radixBuckets; ++bucket) {
+                if(count[bucket] > 1) {
+                    americanFlagPass(begin + bucketBegin, begin + bucketBegin + count[bucket], shift - 8);
+                }
+                bucketBegin += count[bucket];
+            }
+        }
+    }
+    //* in-place MSD radix sort for integers: needs no buffer besides the per-level bucket counters
+    template<typename Iterator>
+    void americanFlagSort(Iterator begin, Iterator end) {
+        using T = typename std::iterator_traits<Iterator>::value_type;
+        static_assert(std::is_integral_v<T>, "americanFlagSort works only with integer types");
+
+        detail::americanFlagPass(begin, end, static_cast<int>(sizeof(T) * 8 - 8));
+    }
+
+    template<typename Container>
+    void americanFlagSort(Container&& container) {
+        americanFlagSort(std::begin(container), std::end(container));
+    }
+
+//----------------Parallel In-place Radix Sort----------------
+    namespace detail /*helper functions for parallel in-place Radix Sort*/ {
+        constexpr size_t parallelRadixLimit = 1 << 16; // smaller ranges are sorted by a single thread
+
+        template<typename Function>
+        void runOnThreads(size_t threadCount, Function&& function) {
+            // joins the started threads on every exit, a joinable std::thread must not be destroyed
+            struct JoinGuard {
+                std::vector<std::thread> threads;
+                ~JoinGuard() {
+                    for(std::thread& thread : threads) {
+                        if(thread.joinable()) {
+                            thread.join();
+                        }
+                    }
+                }
+            } guard;
+
+            guard.threads.reserve(threadCount - 1);
+            for(size_t id = 1; id < threadCount; ++id) {
+                guard.threads.emplace_back(function, id);
+            }
+            function(size_t(0));
+        }
+
+        // one distribution pass where every thread owns an equal stripe of every bucket;
+        // elements that cannot be placed inside the own stripes are left for the next round
+        template<typename Iterator>
+        void parallelRadixPass(Iterator begin, Iterator end, int shift, size_t threadCount) {
+            size_t size = std::distance(begin, end);
+            std::vector<std::array<size_t, radixBuckets>> counts(threadCount);
+
+            // every thread histograms its own block of the range
+            runOnThreads(threadCount, [&](size_t id) {
+                std::array<size_t, radixBuckets>& count = counts[id];
+                count.fill(0);
+                size_t blockBegin = size * id / threadCount;
+                size_t blockEnd   = size * (id + 1) / threadCount;
+                for(size_t i = blockBegin; i < blockEnd; ++i) {
+                    ++count[radixDigit(begin[i], shift)];
+                }
+            });
+
+            size_t globalHead[radixBuckets];
+            size_t globalTail[radixBuckets];
+            size_t bucketSize[radixBuckets];
+            size_t offset = 0;
+            for(size_t bucket = 0; bucket < radixBuckets; ++bucket) {
+                bucketSize[bucket] = 0;
+                for(size_t id = 0; id < threadCount; ++id) {
+                    bucketSize[bucket] += counts[id][bucket];
+                }
+                globalHead[bucket] = offset;
+                offset += bucketSize[bucket];
+                globalTail[bucket] = offset;
+            }
+
+            // counts[] is reused as the per thread stripe heads, stripeTails as the stripe ends
+            std::vector<std::array<size_t, radixBuckets>> stripeTails(threadCount);
+            size_t remaining = size;
+            while(remaining > threadCount * radixBuckets) {
+                for(size_t bucket = 0; bucket < radixBuckets; ++bucket) {
+                    size_t length = globalTail[bucket] - globalHead[bucket];
+                    for(size_t id = 0; id < threadCount; ++id) {
+                        counts[id][bucket]      = globalHead[bucket] + length * id / threadCount;
+                        stripeTails[id][bucket] = globalHead[bucket] + length * (id + 1) / threadCount;
+                    }
+                }
+
+                runOnThreads(threadCount, [&](size_t id) {
+                    std::array<size_t, radixBuckets>& head = counts[id];
+                    std::array<size_t, radixBuckets>& tail = stripeTails[id];
+                    for(size_t bucket = 0; bucket < radixBuckets; ++bucket) {
+                        while(head[bucket] < tail[bucket]) {
+                            size_t digit = radixDigit(begin[head[bucket]], shift);
+                            if(digit == bucket) {
+                                ++head[bucket];
+                            } else if(head[digit] < tail[digit]) {
+                                std::iter_swap(begin + head[bucket], begin + head[digit]++);
+                            } else {
+                                // no room in the own stripe: park it at the stripe end
+                                std::iter_swap(begin + head[bucket], begin + --tail[bucket]);
+                            }
+                        }
+                    }
+                });
+
+                // repair: gather the parked elements of every bucket behind its placed ones
+                std::atomic<size_t> nextBucket{0};
+                runOnThreads(threadCount, [&](size_t) {
+                    for(size_t bucket = nextBucket++; bucket < radixBuckets; bucket = nextBucket++) {
+                        Iterator middle = std::partition(begin + globalHead[bucket], begin + globalTail[bucket],
+                            [&](const auto& value) { return radixDigit(value, shift) == bucket; });
+                        globalHead[bucket] = std::distance(begin, middle);
+                    }
+                });
+
+                size_t stillRemaining = 0;
+                for(size_t bucket = 0; bucket < radixBuckets; ++bucket) {
+                    stillRemaining += globalTail[bucket] - globalHead[bucket];
+                }
+                if(stillRemaining == remaining) {
+                    break;
+                }
+                remaining = stillRemaining;
+            }
+            // the few elements that are left are placed by a single thread
+            americanFlagPermute(begin, globalHead, globalTail, shift);
+
+            if(shift == 0) {
+                return;
+            }
+            // big buckets are split between all threads again, the rest is shared out one bucket per thread
+            auto isBigBucket = [&](size_t bucket) {
+                return bucketSize[bucket] > size / threadCount && bucketSize[bucket] > parallelRadixLimit;
+            };
+            size_t bucketBegin = 0;
+            size_t bucketStart[radixBuckets];
+            for(size_t bucket = 0; bucket < radixBuckets; ++bucket) {
+                bucketStart[bucket] = bucketBegin;
+                bucketBegin += bucketSize[bucket];
+                if(isBigBucket(bucket)) {
+                    parallelRadixPass(begin + bucketStart[bucket], begin + bucketBegin, shift - 8, threadCount);
+                }
+            }
+            std::atomic<size_t> nextBucket{0};
+            runOnThreads(threadCount, [&](size_t) {
+                for(size_t bucket = nextBucket++; bucket < radixBuckets; bucket = nextBucket++) {
+                    if(bucketSize[bucket] > 1 && !isBigBucket(bucket)) {
+                        Iterator bucketFirst = begin + bucketStart[bucket];
+                        americanFlagPass(bucketFirst, bucketFirst + bucketSize[bucket], shift - 8);
+                    }
+                }
+            });
+        }
+    }
+    //* parallel version of americanFlagSort: threads histogram and permute their own blocks,
+    //* so the extra memory is O(256 * threadCount) counters; threadCount = 0 uses every hardware thread
+    template<typename Iterator>
+    void parallelRadixSort(Iterator begin, Iterator end, size_t threadCount = 0) {
+        using T = typename std::iterator_traits<Iterator>::value_type;
+        static_assert(std::is_integral_v<T>, "parallelRadixSort works only with integer types");
+
+        if(threadCount == 0) {
+            threadCount = std::max<size_t>(1, std::thread::hardware_concurrency());
+        }
+        size_t size = std::distance(begin, end);
+        if(threadCount == 1 || size <= detail::parallelRadixLimit) {
+            americanFlagSort(begin, end);
+            return;
+        }
+        detail::parallelRadixPass(begin, end, static_cast<int>(sizeof(T) * 8 - 8), threadCount);
+    }
+
+    template<typename Container>
+    void parallelRadixSort(Container&& container, size_t threadCount = 0) {
+        parallelRadixSort(std::begin(container), std::end(container), threadCount);
+    }
+
 //--------------------Cocktail Sort----------------------
     //* this template function implamants cocktail sort algorith(alsmost the same as the bubble sort)
     template<typename Iterator, typename Compare = std::less<>>
@@ -352,6 +945,210 @@ namespace sort
     void combSort(Container&& container, Compare comp = Compare()) {
         combSort(std::begin(container), std::end(container), comp);
     }
+
+//-----------------Segmented Sort----------------------------
+    namespace detail /*helper functions for Segmented Sort*/ {
+        constexpr size_t segmentNetworkLimit   = 8;       // segments up to this size go through a sorting network
+        constexpr size_t segmentInsertLimit    = 32;      // then insertSort
+        constexpr size_t segmentRadixLimit     = 1024;    // integer segments above this size use americanFlagSort
+        constexpr size_t segmentWorkBytes      = 1 << 18; // a work unit is about the size of a L2 cache
+        constexpr size_t segmentParallelFactor = 4;       // segments of this many parallelRadixLimit per thread use all threads
+
+        // optimal sorting networks for 2..8 elements, written as compare-exchange index pairs
+        constexpr unsigned char network2[][2] = {{0,1}};
+        constexpr unsigned char network3[][2] = {{0,2},{0,1},{1,2}};
+        constexpr unsigned char network4[][2] = {{0,1},{2,3},{0,2},{1,3},{1,2}};
+        constexpr unsigned char network5[][2] = {{0,3},{1,4},{0,2},{1,3},{0,1},{2,4},{1,2},{3,4},{2,3}};
+        constexpr unsigned char network6[][2] = {{0,5},{1,3},{2,4},{1,2},{3,4},{0,3},{2,5},{0,1},{2,3},{4,5},
+                                                 {1,2},{3,4}};
+        constexpr unsigned char network7[][2] = {{0,6},{2,3},{4,5},{0,2},{1,4},{3,6},{0,1},{2,5},{3,4},{1,2},
+                                                 {4,6},{2,3},{4,5},{1,2},{3,4},{5,6}};
+        constexpr unsigned char network8[][2] = {{0,2},{1,3},{4,6},{5,7},{0,4},{1,5},{2,6},{3,7},{0,1},{2,3},
+                                                 {4,5},{6,7},{2,4},{3,5},{1,4},{3,6},{1,2},{3,4},{5,6}};
+
+        template<typename Iterator, size_t Size, typename Compare>
+        void applyNetwork(Iterator begin, const unsigned char (&network)[Size][2], Compare comp) {
+            using T = typename std::iterator_traits<Iterator>::value_type;
+            for(size_t i = 0; i < Size; ++i) {
+                Iterator first  = begin + network[i][0];
+                Iterator second = begin + network[i][1];
+                if constexpr (std::is_trivially_copyable_v<T> && sizeof(T) <= sizeof(void*)) {
+                    // written without a branch so the compiler can use conditional moves
+                    T a = *first;
+                    T b = *second;
+                    bool swapped = comp(b, a);
+                    *first  = swapped ? b : a;
+                    *second = swapped ? a : b;
+                } else if(comp(*second, *first)) {
+                    std::iter_swap(first, second);
+                }
+            }
+        }
+
+        template<typename Iterator, typename Compare>
+        void networkSort(Iterator begin, size_t size, Compare comp) {
+            switch(size) {
+                case 2: applyNetwork(begin, network2, comp); break;
+                case 3: applyNetwork(begin, network3, comp); break;
+                case 4: applyNetwork(begin, network4, comp); break;
+                case 5: applyNetwork(begin, network5, comp); break;
+                case 6: applyNetwork(begin, network6, comp); break;
+                case 7: applyNetwork(begin, network7, comp); break;
+                case 8: applyNetwork(begin, network8, comp); break;
+                default: break;
+            }
+        }
+
+        // integers ordered by less or greater can go through radix sort, greater is an ascending sort reversed
+        template<typename T, typename Compare>
+        constexpr bool segmentRadixAscending = std::is_integral_v<T> &&
+            (std::is_same_v<Compare, std::less<>> || std::is_same_v<Compare, std::less<T>>);
+        template<typename T, typename Compare>
+        constexpr bool segmentRadixDescending = std::is_integral_v<T> &&
+            (std::is_same_v<Compare, std::greater<>> || std::is_same_v<Compare, std::greater<T>>);
+        template<typename T, typename Compare>
+        constexpr bool segmentRadix = segmentRadixAscending<T, Compare> || segmentRadixDescending<T, Compare>;
+
+        template<typename Iterator, typename Compare>
+        void radixSegment(Iterator begin, Iterator end, Compare, size_t threadCount) {
+            using T = typename std::iterator_traits<Iterator>::value_type;
+            parallelRadixSort(begin, end, threadCount);
+            if constexpr (segmentRadixDescending<T, Compare>) {
+                std::reverse(begin, end); // equal integers cannot be told apart, so reversing is exact
+            }
+        }
+
+        // the size class above segmentInsertLimit
+        template<typename Iterator, typename Compare>
+        void sortLargeSegment(Iterator begin, Iterator end, Compare comp) {
+            using T = typename std::iterator_traits<Iterator>::value_type;
+            if constexpr (segmentRadix<T, Compare>) {
+                if(static_cast<size_t>(std::distance(begin, end)) > segmentRadixLimit) {
+                    radixSegment(begin, end, comp, 1);
+                    return;
+                }
+            }
+            quickSort(begin, end, comp);
+        }
+
+        // sorts the segments [firstSegment, lastSegment) one size class per pass,
+        // so every pass runs the same kernel over all of its segments
+        template<typename ValueIterator, typename OffsetIterator, typename Compare>
+        void sortSegments(ValueIterator values, OffsetIterator offsets, size_t firstSegment, size_t lastSegment, Compare comp) {
+            for(size_t segment = firstSegment; segment < lastSegment; ++segment) {
+                size_t size = offsets[segment + 1] - offsets[segment];
+                if(size <= segmentNetworkLimit) {
+                    networkSort(values + offsets[segment], size, comp);
+                }
+            }
+            for(size_t segment = firstSegment; segment < lastSegment; ++segment) {
+                size_t size = offsets[segment + 1] - offsets[segment];
+                if(size > segmentNetworkLimit && size <= segmentInsertLimit) {
+                    insertSort(values + offsets[segment], values + offsets[segment + 1], comp);
+                }
+            }
+            for(size_t segment = firstSegment; segment < lastSegment; ++segment) {
+                size_t size = offsets[segment + 1] - offsets[segment];
+                if(size > segmentInsertLimit) {
+                    sortLargeSegment(values + offsets[segment], values + offsets[segment + 1], comp);
+                }
+            }
+        }
+    }
+    //* sorts every segment [values + offsets[i], values + offsets[i + 1]) of a flat buffer;
+    //* consecutive segments are grouped into cache sized work units that the threads take one by one,
+    //* segments bigger than a unit are sorted afterwards, one per thread or by parallelRadixSort when they are huge
+    //* threadCount = 0 uses every hardware thread
+    template<typename ValueIterator, typename OffsetIterator, typename Compare = std::less<>>
+    void segmentedSort(ValueIterator values, OffsetIterator offsetsBegin, OffsetIterator offsetsEnd,
+                       size_t threadCount = 0, Compare comp = Compare()) {
+        using T = typename std::iterator_traits<ValueIterator>::value_type;
+        size_t segmentCount = std::distance(offsetsBegin, offsetsEnd);
+        if(segmentCount < 2) {
+            return;
+        }
+        --segmentCount; // the last offset only closes the last segment
+
+        if(threadCount == 0) {
+            threadCount = std::max<size_t>(1, std::thread::hardware_concurrency());
+        }
+        const size_t unitElements = std::max<size_t>(1, detail::segmentWorkBytes / sizeof(T));
+        size_t totalElements = offsetsBegin[segmentCount] - offsetsBegin[0];
+        if(threadCount == 1 || totalElements <= unitElements) {
+            detail::sortSegments(values, offsetsBegin, 0, segmentCount, comp);
+            return;
+        }
+
+        // every unit is a range of segments [first, second); a big segment closes the unit before it
+        std::vector<std::pair<size_t, size_t>> units;
+        std::vector<size_t> bigSegments;
+        units.reserve(2 * (totalElements / unitElements) + 1);
+        bigSegments.reserve(totalElements / unitElements);
+        size_t unitFirst = 0;
+        size_t unitSize  = 0;
+        for(size_t segment = 0; segment < segmentCount; ++segment) {
+            size_t size = offsetsBegin[segment + 1] - offsetsBegin[segment];
+            if(size >= unitElements) {
+                if(unitFirst < segment) {
+                    units.emplace_back(unitFirst, segment);
+                }
+                bigSegments.push_back(segment);
+                unitFirst = segment + 1;
+                unitSize  = 0;
+                continue;
+            }
+            unitSize += size;
+            if(unitSize >= unitElements) {
+                units.emplace_back(unitFirst, segment + 1);
+                unitFirst = segment + 1;
+                unitSize  = 0;
+            }
+        }
+        if(unitFirst < segmentCount) {
+            units.emplace_back(unitFirst, segmentCount);
+        }
+
+        if(!units.empty()) {
+            std::atomic<size_t> nextUnit{0};
+            detail::runOnThreads(std::min(threadCount, units.size()), [&](size_t) {
+                for(size_t unit = nextUnit++; unit < units.size(); unit = nextUnit++) {
+                    detail::sortSegments(values, offsetsBegin, units[unit].first, units[unit].second, comp);
+                }
+            });
+        }
+
+        // integer segments far beyond parallelRadixLimit per thread, or all of them when there are fewer big
+        // segments than threads, are sorted by every thread at once; the rest go one segment per thread
+        auto sharedEnd = bigSegments.end();
+        if constexpr (detail::segmentRadix<T, Compare>) {
+            bool fewSegments = bigSegments.size() < threadCount;
+            sharedEnd = std::partition(bigSegments.begin(), bigSegments.end(), [&](size_t segment) {
+                size_t size = offsetsBegin[segment + 1] - offsetsBegin[segment];
+                return size <= detail::parallelRadixLimit ||
+                       (!fewSegments && size < detail::segmentParallelFactor * detail::parallelRadixLimit * threadCount);
+            });
+        }
+        size_t sharedCount = std::distance(bigSegments.begin(), sharedEnd);
+        if(sharedCount != 0) {
+            std::atomic<size_t> nextSegment{0};
+            detail::runOnThreads(std::min(threadCount, sharedCount), [&](size_t) {
+                for(size_t index = nextSegment++; index < sharedCount; index = nextSegment++) {
+                    size_t segment = bigSegments[index];
+                    detail::sortLargeSegment(values + offsetsBegin[segment], values + offsetsBegin[segment + 1], comp);
+                }
+            });
+        }
+        if constexpr (detail::segmentRadix<T, Compare>) {
+            for(auto segment = sharedEnd; segment != bigSegments.end(); ++segment) {
+                detail::radixSegment(values + offsetsBegin[*segment], values + offsetsBegin[*segment + 1], comp, threadCount);
+            }
+        }
+    }
+
+    template<typename Values, typename Offsets, typename Compare = std::less<>>
+    void segmentedSort(Values&& values, const Offsets& offsets, size_t threadCount = 0, Compare comp = Compare()) {
+        segmentedSort(std::begin(values), std::begin(offsets), std::end(offsets), threadCount, comp);
+    }
 } // namespace sort
 
 
@@ -0,0 +1,137 @@
+// Benchmark for blockMergeSort against std::stable_sort under a constrained allocator:
+// the global operator new refuses every allocation that would raise the live heap above a budget,
+// so std::stable_sort has to run with whatever temporary buffer it still gets.
+// usage: merge_bench [size]
+#include "../SortAlgorithms.h"
+
+#include <malloc.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <new>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+    constexpr size_t unlimited = std::numeric_limits<size_t>::max();
+
+    size_t liveBytes  = 0;
+    size_t peakBytes  = 0;
+    size_t limitBytes = unlimited;
+
+    void* allocate(size_t size) {
+        if(size > limitBytes - liveBytes) {
+            return nullptr;
+        }
+        void* memory = std::malloc(size == 0 ? 1 : size);
+        if(memory != nullptr) {
+            liveBytes += malloc_usable_size(memory);
+            peakBytes = std::max(peakBytes, liveBytes);
+        }
+        return memory;
+    }
+
+    void deallocate(void* memory) {
+        if(memory != nullptr) {
+            liveBytes -= malloc_usable_size(memory);
+            std::free(memory);
+        }
+    }
+}
+
+void* operator new(size_t size) {
+    if(void* memory = allocate(size)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+void* operator new[](size_t size) { return operator new(size); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return allocate(size); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return allocate(size); }
+void operator delete(void* memory) noexcept { deallocate(memory); }
+void operator delete[](void* memory) noexcept { deallocate(memory); }
+void operator delete(void* memory, size_t) noexcept { deallocate(memory); }
+void operator delete[](void* memory, size_t) noexcept { deallocate(memory); }
+void operator delete(void* memory, const std::nothrow_t&) noexcept { deallocate(memory); }
+void operator delete[](void* memory, const std::nothrow_t&) noexcept { deallocate(memory); }
+
+namespace {
+    struct Result {
+        double ms;
+        size_t extraBytes;
+    };
+
+    // runs function with at most budget bytes of extra heap and reports the time and the extra peak
+    template<typename Function>
+    Result runWithBudget(size_t budget, Function&& function) {
+        limitBytes = budget == unlimited ? unlimited : liveBytes + budget;
+        size_t baseline = liveBytes;
+        peakBytes = liveBytes;
+        auto start = std::chrono::steady_clock::now();
+        function();
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        limitBytes = unlimited;
+        return {ms, peakBytes - baseline};
+    }
+
+    void fillRandom(std::vector<uint32_t>& data) {
+        std::mt19937 generator(42);
+        for(uint32_t& value : data) {
+            value = generator();
+        }
+    }
+
+    // equal keys must keep the order of their original positions; with few distinct keys the rotation
+    // fallback runs, with many the block merge, once with the internal and once with the caller buffer
+    bool checkStability(int keyRange, size_t bufferSize) {
+        std::vector<std::pair<int, int>> data(100'000);
+        std::mt19937 generator(7);
+        for(size_t i = 0; i < data.size(); ++i) {
+            data[i] = {static_cast<int>(generator() % keyRange), static_cast<int>(i)};
+        }
+        auto byKey = [](const auto& left, const auto& right) { return left.first < right.first; };
+        std::vector<std::pair<int, int>> buffer(bufferSize);
+        sort::blockMergeSort(data.begin(), data.end(), buffer.begin(), buffer.size(), byKey);
+        return std::is_sorted(data.begin(), data.end());
+    }
+}
+
+int main(int argc, char* argv[]) {
+    size_t size = argc > 1 ? std::stoull(argv[1]) : 2'000'000;
+
+    if(!checkStability(100, 0) || !checkStability(50'000, 0) || !checkStability(50'000, 1024)) {
+        std::cerr << "blockMergeSort: result is not stable\n";
+        return 1;
+    }
+
+    std::vector<uint32_t> data(size);
+    const std::pair<const char*, size_t> budgets[] = {
+        {"unlimited", unlimited}, {"64 KB", 64 * 1024}, {"0 B", 0}
+    };
+    for(const auto& [name, budget] : budgets) {
+        fillRandom(data);
+        Result stable = runWithBudget(budget, [&] { std::stable_sort(data.begin(), data.end()); });
+
+        // blockMergeSort gets the largest buffer the budget allows, half of the data at most
+        fillRandom(data);
+        Result block = runWithBudget(budget, [&] {
+            size_t bufferSize = budget == unlimited ? size / 2 : std::min(size / 2, budget / sizeof(uint32_t) / 2);
+            std::vector<uint32_t> buffer(bufferSize);
+            sort::blockMergeSort(data.begin(), data.end(), buffer.begin(), buffer.size());
+        });
+        if(!std::is_sorted(data.begin(), data.end())) {
+            std::cerr << "blockMergeSort: result is not sorted\n";
+            return 1;
+        }
+
+        std::cout << "budget " << name << ":\n"
+                  << "  std::stable_sort:  " << stable.ms  << " ms, extra heap " << stable.extraBytes  << " B\n"
+                  << "  blockMergeSort:    " << block.ms   << " ms, extra heap " << block.extraBytes   << " B\n";
+    }
+    return 0;
+}
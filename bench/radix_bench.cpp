@@ -0,0 +1,73 @@
+// Benchmark for the in-place radix sorts: checks that the result is sorted,
+// reports the extra peak memory of parallelRadixSort and its speedup over americanFlagSort.
+// usage: radix_bench [size] [threads]
+#include "../SortAlgorithms.h"
+
+#include <sys/resource.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+    long peakRssKb() {
+        rusage usage{};
+        getrusage(RUSAGE_SELF, &usage);
+        return usage.ru_maxrss; // kilobytes on Linux
+    }
+
+    void fillRandom(std::vector<int64_t>& data) {
+        std::mt19937_64 generator(42);
+        for(int64_t& value : data) {
+            value = static_cast<int64_t>(generator());
+        }
+    }
+
+    template<typename Function>
+    double measureMs(Function&& function) {
+        auto start = std::chrono::steady_clock::now();
+        function();
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+int main(int argc, char* argv[]) {
+    size_t size        = argc > 1 ? std::stoull(argv[1]) : 20'000'000;
+    size_t threadCount = argc > 2 ? std::stoull(argv[2]) : 0;
+    if(threadCount == 0) {
+        threadCount = std::max<size_t>(1, std::thread::hardware_concurrency());
+    }
+
+    // the data is allocated and touched before the sort, so the rise of the peak RSS is the sort's own memory
+    std::vector<int64_t> data(size);
+    fillRandom(data);
+    long rssBefore = peakRssKb();
+    double parallelMs = measureMs([&] { sort::parallelRadixSort(data, threadCount); });
+    long rssAfter = peakRssKb();
+    if(!std::is_sorted(data.begin(), data.end())) {
+        std::cerr << "parallelRadixSort: result is not sorted\n";
+        return 1;
+    }
+
+    fillRandom(data);
+    double sequentialMs = measureMs([&] { sort::americanFlagSort(data); });
+    if(!std::is_sorted(data.begin(), data.end())) {
+        std::cerr << "americanFlagSort: result is not sorted\n";
+        return 1;
+    }
+
+    fillRandom(data);
+    double stdSortMs = measureMs([&] { std::sort(data.begin(), data.end()); });
+
+    std::cout << "elements:           " << size << " (" << size * sizeof(int64_t) / 1024 << " KB)\n"
+              << "threads:            " << threadCount << '\n'
+              << "std::sort:          " << stdSortMs << " ms\n"
+              << "americanFlagSort:   " << sequentialMs << " ms\n"
+              << "parallelRadixSort:  " << parallelMs << " ms (speedup " << sequentialMs / parallelMs << "x)\n"
+              << "extra peak RSS:     " << rssAfter - rssBefore << " KB\n";
+    return 0;
+}
@@ -0,0 +1,86 @@
+// Benchmark for segmentedSort: throughput in segments per second for every size class,
+// compared with calling std::sort on each segment; fails when the results differ.
+// usage: segmented_bench [segments] [threads]
+#include "../SortAlgorithms.h"
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+    struct Workload {
+        const char* name;
+        size_t minSize;
+        size_t maxSize;
+    };
+
+    // insertSort must copy the element out of a proxy reference, not keep the proxy
+    bool checkProxyReferences() {
+        const std::vector<bool> input    = {true, false, true, false, false, true};
+        const std::vector<bool> expected = {false, false, false, true, true, true};
+        std::vector<bool> byIterators = input;
+        std::vector<bool> byContainer = input;
+        sort::insertSort(byIterators.begin(), byIterators.end());
+        sort::insertSort(byContainer);
+        return byIterators == expected && byContainer == expected;
+    }
+
+    template<typename Function>
+    double measureSeconds(Function&& function) {
+        auto start = std::chrono::steady_clock::now();
+        function();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+int main(int argc, char* argv[]) {
+    size_t segmentCount = argc > 1 ? std::stoull(argv[1]) : 1'000'000;
+    size_t threadCount  = argc > 2 ? std::stoull(argv[2]) : 0;
+
+    if(!checkProxyReferences()) {
+        std::cerr << "insertSort: std::vector<bool> is not sorted correctly\n";
+        return 1;
+    }
+
+    const Workload workloads[] = {
+        {"2-8 (networks)",       2,    8},
+        {"9-32 (insertSort)",    9,    32},
+        {"33-1000 (quick sort)", 33,   1000},
+        {"10-1000 (mixed)",      10,   1000},
+        {"1000-4000 (radix)",    1000, 4000},
+    };
+    std::mt19937 generator(42);
+    for(const Workload& workload : workloads) {
+        std::vector<uint32_t> offsets;
+        offsets.reserve(segmentCount + 1);
+        offsets.push_back(0);
+        std::uniform_int_distribution<size_t> sizes(workload.minSize, workload.maxSize);
+        for(size_t segment = 0; segment < segmentCount; ++segment) {
+            offsets.push_back(static_cast<uint32_t>(offsets.back() + sizes(generator)));
+        }
+        std::vector<int32_t> values(offsets.back());
+        for(int32_t& value : values) {
+            value = static_cast<int32_t>(generator());
+        }
+        std::vector<int32_t> expected = values;
+
+        double segmentedSeconds = measureSeconds([&] { sort::segmentedSort(values, offsets, threadCount); });
+        double stdSortSeconds = measureSeconds([&] {
+            for(size_t segment = 0; segment < segmentCount; ++segment) {
+                std::sort(expected.begin() + offsets[segment], expected.begin() + offsets[segment + 1]);
+            }
+        });
+        if(values != expected) {
+            std::cerr << workload.name << ": segmentedSort result differs from std::sort\n";
+            return 1;
+        }
+
+        std::cout << workload.name << ":\n"
+                  << "  segmentedSort:      " << segmentCount / segmentedSeconds << " segments/s\n"
+                  << "  std::sort per call: " << segmentCount / stdSortSeconds   << " segments/s\n";
+    }
+    return 0;
+}